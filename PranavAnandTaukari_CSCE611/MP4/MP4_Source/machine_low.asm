@@ -15,4 +15,17 @@ global _get_EFLAGS
 _get_EFLAGS:
 	pushfd			; push eflags
 	pop	eax		; pop contents into eax
-	ret
\ No newline at end of file
+	ret
+
+; ----------------------------------------------------------------------
+; get_TSC()
+; 
+; Returns value of the time-stamp counter. The 64-bit result is
+; returned in edx:eax, which is where rdtsc puts it.
+;
+; ----------------------------------------------------------------------
+global _get_TSC
+; this function is exported.
+_get_TSC:
+	rdtsc			; read time-stamp counter into edx:eax
+	ret